@@ -135,7 +135,14 @@
  */
 @property (nonatomic, assign) BOOL featured;
 
+/**
+ * URL to a large version of the 360 photo.
+ */
 @property (nonatomic, strong) NSString *largeURL;
+
+/**
+ * URL to the original 360 photo, may exceed the maximum texture size of the device.
+ */
 @property (nonatomic, strong) NSString *originalURL;
 
 @end
@@ -106,6 +106,13 @@
  */
 -(void)initVideoWithVideoItem:(LSVideoItem*)videoItem contentManager:(LSContentManager*)contentManager licenseFileUrl:(NSURL *)licenseFileUrl;
 
+/**
+ *  Initializes 360 image with given image, license file url.
+ *
+ *  @param image           The equirectangular 360 image
+ *  @param licenseFileUrl  Url to license file
+ *  @param token           Access token
+ */
 -(void)initPhotowithPhotoItem:(UIImage*)image licenseFileUrl:(NSURL *)licenseFileUrl token:(NSString *)token;
   
 /**